@@ -0,0 +1,600 @@
+/*
+ * Набор бенчмарков для всех трех лабораторных работ, без интерактивного ввода.
+ * Каждый замер повторяется несколько раз, в результаты попадают минимальное и медианное время,
+ * аппаратные счетчики (если perf_event_open доступен) и счетчики инструментации.
+ *
+ * Сборка (из корня репозитория):
+ *   g++ -std=c++17 -O2 -pthread -DLAB_INSTRUMENTATION bench/bench.cpp common/instrumentation.cpp \
+ *       lab1/eratosthenes.cpp lab2/matrix.cpp lab3/string_queries.cpp -o lab_bench
+ *
+ * Сборка самих лабораторных (каждая программа собирается вместе со своей библиотекой;
+ * без -DLAB_INSTRUMENTATION макросы инструментации пустые и common/instrumentation.cpp не нужен):
+ *   g++ -std=c++17 -O2 lab1/main.cpp lab1/eratosthenes.cpp -o lab1_sieve
+ *   g++ -std=c++17 -O2 lab2/main2.cpp lab2/matrix.cpp -o lab2_matrix
+ *   g++ -std=c++17 -O2 lab3/main.cpp lab3/string_queries.cpp -o lab3_strings
+ *
+ * Параметры командной строки:
+ *   --format csv|json    формат результатов (по умолчанию csv)
+ *   --output <path>      файл для результатов (по умолчанию стандартный вывод)
+ *   --repeat <k>         количество повторов каждого замера (по умолчанию 5)
+ *   --seed <s>           начальное значение генераторов случайных чисел (по умолчанию 42)
+ *   --sieve a,b,...      значения n для решета Эратосфена
+ *   --matrix a,b,...     размеры матриц
+ *   --corpus a,b,...     количество строк корпуса lab3
+ *   --threads a,b,...    количество потоков для параллельных запросов lab3
+ *   --queries <q>        количество случайных подстрок для поиска в lab3 (по умолчанию 100);
+ *                        линейный поиск, поиск по индексу и по файлу выполняются по одному набору
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "../common/instrumentation.h"
+#include "../lab1/eratosthenes.h"
+#include "../lab2/matrix.h"
+#include "../lab3/string_queries.h"
+
+using namespace std;
+
+/*
+ * Параметры запуска бенчмарков
+ */
+struct BenchConfig {
+    string format = "csv";
+    string outputPath;
+    int repeat = 5;
+    unsigned seed = 42;
+    vector<int> sieveSizes = {100000, 1000000, 10000000};
+    vector<int> matrixSizes = {16, 256, 1024};
+    vector<int> corpusSizes = {10000, 100000, 500000};
+    vector<int> threadCounts = {1, 2, 4};
+    int queries = 100;
+};
+
+/*
+ * Результат одного замера (одна строка CSV или один объект JSON)
+ */
+struct BenchResult {
+    string lab;              // Лабораторная работа (lab1, lab2, lab3)
+    string name;             // Название замера
+    string param;            // Название варьируемого параметра
+    long long value = 0;     // Значение параметра
+    int threads = 1;         // Количество потоков
+    int repeat = 0;          // Количество повторов
+    uint64_t ops = 1;        // Количество операций за один повтор (например, запросов)
+    uint64_t minNs = 0;      // Минимальное время повтора
+    uint64_t medianNs = 0;   // Медианное время повтора
+    instrumentation::HardwareSample hardware;            // Аппаратные счетчики самого быстрого повтора
+    map<string, instrumentation::Stat> counters;         // Счетчики инструментации последнего повтора
+};
+
+/*
+ * Создание описания замера
+ * Параметры:
+ *   lab, name, param, value: лабораторная работа, название замера, варьируемый параметр и его значение
+ *   threads: количество потоков
+ * return: описание замера без результатов
+ */
+BenchResult makeResult(const string& lab, const string& name, const string& param, long long value,
+                       int threads = 1) {
+    BenchResult result;
+    result.lab = lab;
+    result.name = name;
+    result.param = param;
+    result.value = value;
+    result.threads = threads;
+    return result;
+}
+
+/*
+ * Среднее время одной операции с фиксированной точностью (без экспоненциальной записи)
+ */
+string nsPerOp(const BenchResult& result) {
+    ostringstream out;
+    out << fixed << setprecision(1) << static_cast<double>(result.medianNs) / result.ops;
+    return out.str();
+}
+
+volatile uint64_t benchSink = 0;  // Приемник результатов, чтобы компилятор не удалил замеряемый код
+
+/*
+ * Разбор неотрицательного целого числа (вся строка должна быть числом)
+ * Параметры:
+ *   text: строка с числом
+ * return: число; при ошибке выбрасывается invalid_argument или out_of_range
+ */
+int parseNonNegative(const string& text) {
+    size_t parsed = 0;
+    int value = stoi(text, &parsed);
+    if (parsed != text.length() || value < 0) {
+        throw invalid_argument(text);
+    }
+    return value;
+}
+
+/*
+ * Разбор списка неотрицательных чисел через запятую
+ * Параметры:
+ *   text: строка вида "1,2,3"
+ * return: список чисел; при ошибке выбрасывается invalid_argument или out_of_range
+ */
+vector<int> parseList(const string& text) {
+    vector<int> values;
+    stringstream stream(text);
+    string item;
+    while (getline(stream, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(parseNonNegative(item));
+        }
+    }
+    return values;
+}
+
+/*
+ * Выполнение замера: setup вызывается перед каждым повтором вне замера времени
+ * Параметры:
+ *   result: описание замера (заполняются поля времени и счетчиков)
+ *   repeat: количество повторов
+ *   hardware: аппаратные счетчики (nullptr, если замер многопоточный)
+ *   setup: подготовка данных перед повтором
+ *   body: замеряемый код
+ */
+void measure(BenchResult& result, int repeat, instrumentation::HardwareCounters* hardware,
+             const function<void()>& setup, const function<void()>& body) {
+    vector<uint64_t> times;
+    for (int r = 0; r < repeat; ++r) {
+        setup();
+        instrumentation::reset();
+        if (hardware != nullptr) {
+            hardware->start();
+        }
+        auto start = chrono::steady_clock::now();
+        body();
+        auto elapsed = chrono::steady_clock::now() - start;
+        instrumentation::HardwareSample sample;
+        if (hardware != nullptr) {
+            sample = hardware->stop();
+        }
+        uint64_t ns = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(elapsed).count());
+        if (times.empty() || ns < *min_element(times.begin(), times.end())) {
+            result.hardware = sample;
+        }
+        times.push_back(ns);
+    }
+    result.counters = instrumentation::snapshot();
+    sort(times.begin(), times.end());
+    result.repeat = repeat;
+    result.minNs = times.front();
+    result.medianNs = times[times.size() / 2];
+}
+
+/*
+ * Параллельное применение запроса к строкам: массив делится на равные непрерывные части.
+ * При одном потоке запрос выполняется в вызывающем потоке: без затрат на создание потока,
+ * и аппаратные счетчики (они привязаны к потоку) измеряют сам запрос.
+ * Параметры:
+ *   arr: массив строк
+ *   threads: количество потоков
+ *   query: запрос к одной строке
+ * return: сумма результатов запроса по всем строкам
+ */
+template <typename Query>
+uint64_t parallelSum(const vector<string>& arr, int threads, Query query) {
+    if (threads == 1) {
+        uint64_t sum = 0;
+        for (const auto& str : arr) {
+            sum += query(string_view(str));
+        }
+        return sum;
+    }
+
+    vector<uint64_t> partial(threads, 0);
+    vector<thread> workers;
+    size_t chunk = (arr.size() + threads - 1) / threads;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            size_t begin = min(arr.size(), t * chunk);
+            size_t end = min(arr.size(), begin + chunk);
+            uint64_t sum = 0;
+            for (size_t i = begin; i < end; ++i) {
+                sum += query(string_view(arr[i]));
+            }
+            partial[t] = sum;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    uint64_t total = 0;
+    for (uint64_t value : partial) {
+        total += value;
+    }
+    return total;
+}
+
+/*
+ * Бенчмарки lab1: решето Эратосфена
+ */
+void benchSieve(const BenchConfig& config, instrumentation::HardwareCounters& hardware,
+                vector<BenchResult>& results) {
+    for (int n : config.sieveSizes) {
+        BenchResult result = makeResult("lab1", "sieve", "n", n);
+        measure(result, config.repeat, &hardware, [] {}, [n] {
+            benchSink += sieve_of_eratosthenes(n).size();
+        });
+        results.push_back(result);
+    }
+}
+
+/*
+ * Бенчмарки lab2: заполнение матриц
+ */
+void benchMatrix(const BenchConfig& config, instrumentation::HardwareCounters& hardware,
+                 vector<BenchResult>& results) {
+    for (int size : config.matrixSizes) {
+        int** arr = createArr(size);
+        mt19937 generator(config.seed);
+
+        // Значения верхнего треугольника для симметричных заполнений
+        vector<int> values(static_cast<size_t>(size) * (size + 1) / 2);
+        uniform_int_distribution<int> distribution(-1000, 1000);
+        for (int& value : values) {
+            value = distribution(generator);
+        }
+        auto clear = [arr, size] { fillWithZeros(arr, size); };
+
+        BenchResult zeros = makeResult("lab2", "zeros", "size", size);
+        measure(zeros, config.repeat, &hardware, [] {}, clear);
+        results.push_back(zeros);
+
+        BenchResult mainDiagonal = makeResult("lab2", "main_diagonal", "size", size);
+        measure(mainDiagonal, config.repeat, &hardware, clear, [&] {
+            fillMainDiagonalSymmetric(arr, size, values);
+        });
+        results.push_back(mainDiagonal);
+
+        BenchResult secDiagonal = makeResult("lab2", "sec_diagonal", "size", size);
+        measure(secDiagonal, config.repeat, &hardware, clear, [&] {
+            fillSecDiagonalSymmetric(arr, size, values);
+        });
+        results.push_back(secDiagonal);
+
+        // Треугольник Паскаля определен только для размеров, при которых значения помещаются в int
+        if (size < PASCAL_MAX_SIZE) {
+            BenchResult pascal = makeResult("lab2", "pascal", "size", size);
+            measure(pascal, config.repeat, &hardware, clear, [&] {
+                benchSink += fillPascalsTriangle(arr, size);
+            });
+            results.push_back(pascal);
+        }
+
+        BenchResult mines = makeResult("lab2", "mines", "size", size);
+        measure(mines, config.repeat, &hardware, clear, [&] {
+            fillMines(arr, size, size * size / 2, generator);
+        });
+        results.push_back(mines);
+
+        freeArr(arr, size);
+    }
+}
+
+/*
+ * Запись корпуса во временный файл с уникальным именем (mkstemp создает файл с O_EXCL,
+ * поэтому параллельные запуски не мешают друг другу, а подложенная ссылка не будет открыта)
+ * Параметры:
+ *   arr: строки корпуса
+ * return: путь к файлу или пустая строка при ошибке; файл удаляет вызывающий код
+ */
+string writeTempCorpus(const vector<string>& arr) {
+    string path = (filesystem::temp_directory_path() / "lab_bench_corpus_XXXXXX").string();
+    int fd = mkstemp(path.data());
+    if (fd < 0) {
+        return "";
+    }
+    FILE* out = fdopen(fd, "wb");
+    if (out == nullptr) {
+        close(fd);
+        unlink(path.c_str());
+        return "";
+    }
+    bool ok = true;
+    for (const auto& str : arr) {
+        ok = ok && fwrite(str.data(), 1, str.length(), out) == str.length() && fputc('\n', out) != EOF;
+    }
+    if (fclose(out) != 0 || !ok) {
+        unlink(path.c_str());
+        return "";
+    }
+    return path;
+}
+
+/*
+ * Бенчмарки lab3: запросы к строкам в памяти, индекс подстрок и корпус через mmap
+ * return: false, если результаты поиска по индексу разошлись с линейным поиском
+ */
+bool benchStrings(const BenchConfig& config, instrumentation::HardwareCounters& hardware,
+                  vector<BenchResult>& results) {
+
+    for (int lines : config.corpusSizes) {
+        srand(config.seed);
+        vector<string> arr(lines);
+        for (auto& str : arr) {
+            str = generateRandomString();
+        }
+        vector<string> queries(config.queries);
+        for (auto& query : queries) {
+            query = generateRandomString(3);
+        }
+
+        BenchResult longest = makeResult("lab3", "longest_repetition", "lines", lines);
+        measure(longest, config.repeat, &hardware, [] {}, [&] {
+            benchSink += findLongestRepetition(arr).length();
+        });
+        results.push_back(longest);
+
+        BenchResult concatenate = makeResult("lab3", "concatenate", "lines", lines);
+        measure(concatenate, config.repeat, &hardware, [] {}, [&] {
+            benchSink += concatenateStrings(arr).length();
+        });
+        results.push_back(concatenate);
+
+        // Линейные запросы с разным количеством потоков
+        for (int threads : config.threadCounts) {
+            instrumentation::HardwareCounters* counters = threads == 1 ? &hardware : nullptr;
+
+            BenchResult countChar = makeResult("lab3", "count_char", "lines", lines, threads);
+            measure(countChar, config.repeat, counters, [] {}, [&] {
+                benchSink += parallelSum(arr, threads, [](string_view str) {
+                    return countCharOccurrences(str, 'a');
+                });
+            });
+            results.push_back(countChar);
+
+            // Каждая подстрока набора ищется по всему массиву отдельно, как и при поиске по индексу
+            BenchResult countSubstring = makeResult("lab3", "count_substring", "lines", lines, threads);
+            countSubstring.ops = queries.size();
+            measure(countSubstring, config.repeat, counters, [] {}, [&] {
+                for (const auto& query : queries) {
+                    benchSink += parallelSum(arr, threads, [&](string_view str) {
+                        return countSubstringOccurrences(str, query);
+                    });
+                }
+            });
+            results.push_back(countSubstring);
+        }
+
+        // Индекс подстрок: построение и пакет запросов
+        SuffixIndex index;
+        BenchResult build = makeResult("lab3", "suffix_index_build", "lines", lines);
+        measure(build, config.repeat, &hardware, [&] { freeSuffixIndex(index); }, [&] {
+            benchSink += buildSuffixIndex(arr, index);
+        });
+        results.push_back(build);
+
+        // Перед замером: поиск по индексу должен совпадать с линейным поиском на всем наборе подстрок
+        for (const auto& query : queries) {
+            int expected = countSubstringOccurrences(arr, query);
+            int actual = countSubstringOccurrencesIndexed(index, query);
+            if (actual != expected) {
+                cerr << "Suffix index mismatch for '" << query << "' at " << lines << " lines: "
+                     << actual << " by index, " << expected << " by linear scan" << endl;
+                freeSuffixIndex(index);
+                return false;
+            }
+        }
+
+        // Отдельный запрос слишком короткий для таймера внутри функции, поэтому замеряется весь пакет
+        BenchResult indexed = makeResult("lab3", "count_substring_indexed", "lines", lines);
+        indexed.ops = queries.size();
+        measure(indexed, config.repeat, &hardware, [] {}, [&] {
+            for (const auto& query : queries) {
+                benchSink += countSubstringOccurrencesIndexed(index, query);
+            }
+        });
+        results.push_back(indexed);
+        freeSuffixIndex(index);
+
+        // Тот же корпус из файла через mmap
+        string corpusPath = writeTempCorpus(arr);
+        if (corpusPath.empty()) {
+            cerr << "Failed to create a temporary corpus file, skipping mapped corpus benchmarks" << endl;
+            continue;
+        }
+        MappedCorpus corpus;
+        BenchResult openCorpus = makeResult("lab3", "corpus_open", "lines", lines);
+        measure(openCorpus, config.repeat, &hardware, [&] { closeMappedCorpus(corpus); }, [&] {
+            benchSink += openMappedCorpus(corpusPath, corpus);
+        });
+        results.push_back(openCorpus);
+
+        BenchResult mappedChar = makeResult("lab3", "corpus_count_char", "lines", lines);
+        measure(mappedChar, config.repeat, &hardware, [] {}, [&] {
+            benchSink += countCharOccurrences(corpus, 'a');
+        });
+        results.push_back(mappedChar);
+
+        BenchResult mappedSubstring = makeResult("lab3", "corpus_count_substring", "lines", lines);
+        mappedSubstring.ops = queries.size();
+        measure(mappedSubstring, config.repeat, &hardware, [] {}, [&] {
+            for (const auto& query : queries) {
+                benchSink += countSubstringOccurrences(corpus, query);
+            }
+        });
+        results.push_back(mappedSubstring);
+        closeMappedCorpus(corpus);
+        unlink(corpusPath.c_str());
+    }
+    return true;
+}
+
+/*
+ * Экранирование строки для JSON
+ */
+string jsonString(const string& text) {
+    string escaped = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+/*
+ * Вывод результатов в формате CSV (счетчики инструментации - в одном поле через ';')
+ */
+void writeCsv(const vector<BenchResult>& results, ostream& out) {
+    out << "lab,benchmark,param,value,threads,repeat,ops,min_ns,median_ns,ns_per_op,"
+           "cycles,cache_misses,branch_misses,counters\n";
+    for (const auto& r : results) {
+        out << r.lab << ',' << r.name << ',' << r.param << ',' << r.value << ',' << r.threads << ','
+            << r.repeat << ',' << r.ops << ',' << r.minNs << ',' << r.medianNs << ','
+            << nsPerOp(r) << ',';
+        if (r.hardware.available) {
+            out << r.hardware.cycles << ',' << r.hardware.cacheMisses << ',' << r.hardware.branchMisses << ',';
+        } else {
+            out << ",,,";
+        }
+        bool first = true;
+        for (const auto& [name, stat] : r.counters) {
+            out << (first ? "" : ";") << name << ".calls=" << stat.calls;
+            if (stat.totalNs > 0) {
+                out << ';' << name << ".ns=" << stat.totalNs;
+            }
+            if (stat.value > 0) {
+                out << ';' << name << "=" << stat.value;
+            }
+            first = false;
+        }
+        out << '\n';
+    }
+}
+
+/*
+ * Вывод результатов в формате JSON (массив объектов)
+ */
+void writeJson(const vector<BenchResult>& results, ostream& out) {
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        out << "  {\"lab\": " << jsonString(r.lab) << ", \"benchmark\": " << jsonString(r.name)
+            << ", \"param\": " << jsonString(r.param) << ", \"value\": " << r.value
+            << ", \"threads\": " << r.threads << ", \"repeat\": " << r.repeat << ", \"ops\": " << r.ops
+            << ", \"min_ns\": " << r.minNs << ", \"median_ns\": " << r.medianNs
+            << ", \"ns_per_op\": " << nsPerOp(r);
+        if (r.hardware.available) {
+            out << ", \"cycles\": " << r.hardware.cycles << ", \"cache_misses\": " << r.hardware.cacheMisses
+                << ", \"branch_misses\": " << r.hardware.branchMisses;
+        } else {
+            out << ", \"cycles\": null, \"cache_misses\": null, \"branch_misses\": null";
+        }
+        out << ", \"counters\": {";
+        bool first = true;
+        for (const auto& [name, stat] : r.counters) {
+            out << (first ? "" : ", ") << jsonString(name) << ": {\"calls\": " << stat.calls
+                << ", \"ns\": " << stat.totalNs << ", \"value\": " << stat.value << "}";
+            first = false;
+        }
+        out << "}}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+/*
+ * Основная функция: разбор параметров, выполнение всех замеров и вывод результатов
+ */
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            cerr << "Missing value for option " << arg << endl;
+            return 1;
+        }
+        string value = argv[++i];
+        try {
+            if (arg == "--format") {
+                config.format = value;
+            } else if (arg == "--output") {
+                config.outputPath = value;
+            } else if (arg == "--repeat") {
+                config.repeat = parseNonNegative(value);
+            } else if (arg == "--seed") {
+                config.seed = static_cast<unsigned>(parseNonNegative(value));
+            } else if (arg == "--sieve") {
+                config.sieveSizes = parseList(value);
+            } else if (arg == "--matrix") {
+                config.matrixSizes = parseList(value);
+            } else if (arg == "--corpus") {
+                config.corpusSizes = parseList(value);
+            } else if (arg == "--threads") {
+                config.threadCounts = parseList(value);
+            } else if (arg == "--queries") {
+                config.queries = parseNonNegative(value);
+            } else {
+                cerr << "Unknown option " << arg << endl;
+                return 1;
+            }
+        } catch (const logic_error&) {  // invalid_argument и out_of_range из разбора чисел
+            cerr << "Invalid value '" << value << "' for option " << arg
+                 << " (expected non-negative integers)" << endl;
+            return 1;
+        }
+    }
+    if (config.repeat < 1 || config.queries < 1) {
+        cerr << "Repeat and query counts must be positive" << endl;
+        return 1;
+    }
+    if (config.format != "csv" && config.format != "json") {
+        cerr << "Unknown format " << config.format << " (expected csv or json)" << endl;
+        return 1;
+    }
+    for (int threads : config.threadCounts) {
+        if (threads < 1) {
+            cerr << "Thread count must be positive" << endl;
+            return 1;
+        }
+    }
+
+    instrumentation::HardwareCounters hardware;
+    if (!hardware.available()) {
+        cerr << "Hardware counters are unavailable (perf_event_open failed), reporting time only" << endl;
+    }
+
+    vector<BenchResult> results;
+    benchSieve(config, hardware, results);
+    benchMatrix(config, hardware, results);
+    if (!benchStrings(config, hardware, results)) {
+        return 1;
+    }
+
+    ofstream file;
+    if (!config.outputPath.empty()) {
+        file.open(config.outputPath, ios::trunc);
+        if (!file) {
+            cerr << "Failed to open " << config.outputPath << endl;
+            return 1;
+        }
+    }
+    ostream& out = config.outputPath.empty() ? cout : file;
+    if (config.format == "json") {
+        writeJson(results, out);
+    } else {
+        writeCsv(results, out);
+    }
+    return 0;
+}
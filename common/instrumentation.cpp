@@ -0,0 +1,145 @@
+#include "instrumentation.h"
+
+#include <memory>
+#include <mutex>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+using namespace std;
+
+namespace instrumentation {
+
+/*
+ * Общий реестр точек инструментации (функция-хранилище, чтобы избежать проблем порядка инициализации).
+ * Точки никогда не удаляются, поэтому ссылки, сохраненные в статических переменных, остаются действительными.
+ */
+static map<string, unique_ptr<Site>>& registry() {
+    static map<string, unique_ptr<Site>> sites;
+    return sites;
+}
+
+static mutex& registryMutex() {
+    static mutex m;
+    return m;
+}
+
+Site& registerSite(const char* name) {
+    lock_guard<mutex> lock(registryMutex());
+    unique_ptr<Site>& site = registry()[name];  // Одинаковые имена в разных местах делят одну точку
+    if (!site) {
+        site = make_unique<Site>();
+    }
+    return *site;
+}
+
+map<string, Stat> snapshot() {
+    lock_guard<mutex> lock(registryMutex());
+    map<string, Stat> stats;
+    for (const auto& [name, site] : registry()) {
+        Stat stat;
+        stat.calls = site->calls.load(memory_order_relaxed);
+        stat.totalNs = site->totalNs.load(memory_order_relaxed);
+        stat.value = site->value.load(memory_order_relaxed);
+        if (stat.calls > 0) {  // Точки, не срабатывавшие с последнего reset, не попадают в результат
+            stats[name] = stat;
+        }
+    }
+    return stats;
+}
+
+void reset() {
+    lock_guard<mutex> lock(registryMutex());
+    for (auto& entry : registry()) {
+        entry.second->calls.store(0, memory_order_relaxed);
+        entry.second->totalNs.store(0, memory_order_relaxed);
+        entry.second->value.store(0, memory_order_relaxed);
+    }
+}
+
+#ifdef __linux__
+/*
+ * Открытие одного аппаратного счетчика текущего потока (только пользовательский режим)
+ * Параметры:
+ *   config: тип события PERF_COUNT_HW_*
+ *   groupFd: дескриптор лидера группы или -1 для самого лидера
+ * return: дескриптор счетчика или -1 при ошибке
+ */
+static int openHardwareEvent(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = groupFd < 0 ? 1 : 0;  // Группа включается целиком через лидера
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+#endif
+
+HardwareCounters::HardwareCounters() {
+#ifdef __linux__
+    leader_ = openHardwareEvent(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (leader_ < 0) {
+        return;
+    }
+    cacheMisses_ = openHardwareEvent(PERF_COUNT_HW_CACHE_MISSES, leader_);
+    branchMisses_ = openHardwareEvent(PERF_COUNT_HW_BRANCH_MISSES, leader_);
+    if (cacheMisses_ < 0 || branchMisses_ < 0) {
+        // Неполная группа бесполезна: отключаем аппаратные счетчики целиком
+        if (cacheMisses_ >= 0) {
+            close(cacheMisses_);
+        }
+        if (branchMisses_ >= 0) {
+            close(branchMisses_);
+        }
+        close(leader_);
+        leader_ = cacheMisses_ = branchMisses_ = -1;
+    }
+#endif
+}
+
+HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+    if (leader_ >= 0) {
+        close(branchMisses_);
+        close(cacheMisses_);
+        close(leader_);
+    }
+#endif
+}
+
+void HardwareCounters::start() {
+#ifdef __linux__
+    if (leader_ >= 0) {
+        ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+HardwareSample HardwareCounters::stop() {
+    HardwareSample sample;
+#ifdef __linux__
+    if (leader_ >= 0) {
+        ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        uint64_t values[4] = {0, 0, 0, 0};  // Количество событий + значения в порядке открытия
+        if (read(leader_, values, sizeof(values)) >= static_cast<ssize_t>(sizeof(uint64_t) * 4) && values[0] == 3) {
+            sample.available = true;
+            sample.cycles = values[1];
+            sample.cacheMisses = values[2];
+            sample.branchMisses = values[3];
+        }
+    }
+#endif
+    return sample;
+}
+
+} // namespace instrumentation
@@ -0,0 +1,119 @@
+#ifndef COMMON_INSTRUMENTATION_H
+#define COMMON_INSTRUMENTATION_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+/*
+ * Легковесная инструментация горячих участков кода: таймеры областей видимости и счетчики.
+ * В коде лабораторных используются только макросы INSTRUMENT_SCOPE / INSTRUMENT_COUNT:
+ * без флага LAB_INSTRUMENTATION они раскрываются в пустые выражения и ничего не стоят,
+ * а с флагом (-DLAB_INSTRUMENTATION, так собирается bench) результаты накапливаются
+ * в общем реестре. Каждое место вызова один раз регистрирует свою точку (Site) в статической
+ * переменной, дальше обновляются только атомарные счетчики: без блокировок и выделения памяти.
+ */
+namespace instrumentation {
+
+/*
+ * Снимок накопленной статистики одного таймера или счетчика
+ */
+struct Stat {
+    uint64_t calls = 0;      // Количество срабатываний таймера или вызовов addCount
+    uint64_t totalNs = 0;    // Суммарное время таймера в наносекундах
+    uint64_t value = 0;      // Сумма значений счетчика
+};
+
+/*
+ * Точка инструментации: атомарные счетчики одного таймера или счетчика
+ */
+struct Site {
+    std::atomic<uint64_t> calls{0};      // Количество срабатываний
+    std::atomic<uint64_t> totalNs{0};    // Суммарное время таймера в наносекундах
+    std::atomic<uint64_t> value{0};      // Сумма значений счетчика
+
+    void recordTime(uint64_t ns) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        totalNs.fetch_add(ns, std::memory_order_relaxed);
+    }
+    void addCount(uint64_t amount) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        value.fetch_add(amount, std::memory_order_relaxed);
+    }
+};
+
+Site& registerSite(const char* name);
+std::map<std::string, Stat> snapshot();
+void reset();
+
+/*
+ * Таймер области видимости: измеряет время от создания до разрушения объекта
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Site& site) : site_(site), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        site_.recordTime(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Site& site_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/*
+ * Значения аппаратных счетчиков за интервал измерения
+ */
+struct HardwareSample {
+    bool available = false;      // false, если perf_event_open недоступен (не Linux, нет прав)
+    uint64_t cycles = 0;         // Такты процессора
+    uint64_t cacheMisses = 0;    // Промахи кеша
+    uint64_t branchMisses = 0;   // Ошибки предсказания переходов
+};
+
+/*
+ * Аппаратные счетчики текущего потока через perf_event_open (группа из трех событий)
+ */
+class HardwareCounters {
+public:
+    HardwareCounters();
+    ~HardwareCounters();
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    bool available() const { return leader_ >= 0; }
+    void start();
+    HardwareSample stop();
+
+private:
+    int leader_ = -1;            // Дескриптор лидера группы (такты)
+    int cacheMisses_ = -1;       // Дескриптор счетчика промахов кеша
+    int branchMisses_ = -1;      // Дескриптор счетчика ошибок предсказания переходов
+};
+
+} // namespace instrumentation
+
+#define INSTRUMENT_CONCAT_IMPL(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_IMPL(a, b)
+
+#ifdef LAB_INSTRUMENTATION
+#define INSTRUMENT_SCOPE(name) \
+    static ::instrumentation::Site& INSTRUMENT_CONCAT(instrumentSite_, __LINE__) = ::instrumentation::registerSite(name); \
+    ::instrumentation::ScopedTimer INSTRUMENT_CONCAT(instrumentScope_, __LINE__)(INSTRUMENT_CONCAT(instrumentSite_, __LINE__))
+#define INSTRUMENT_COUNT(name, value) \
+    do { \
+        static ::instrumentation::Site& instrumentSite = ::instrumentation::registerSite(name); \
+        instrumentSite.addCount(static_cast<uint64_t>(value)); \
+    } while (0)
+#else
+#define INSTRUMENT_SCOPE(name) ((void)0)
+#define INSTRUMENT_COUNT(name, value) ((void)0)
+#endif
+
+#endif // COMMON_INSTRUMENTATION_H
@@ -0,0 +1,37 @@
+#include "eratosthenes.h"
+
+#include "../common/instrumentation.h"
+
+std::vector<int> sieve_of_eratosthenes(int n) {
+    INSTRUMENT_SCOPE("sieve");
+    std::vector<int> primes;
+    if (n < 2) {
+        return primes; // Простых чисел меньше 2 нет.
+    }
+
+    // Создаем вектор булевых значений для чисел от 0 до n.
+    // Изначально все числа считаются простыми (true), кроме 0 и 1.
+    std::vector<bool> is_prime(n + 1, true);
+    is_prime[0] = is_prime[1] = false; // 0 и 1 не являются простыми числами.
+
+    // Проходим по числам от 2 до √n (предельное значение, где нужно вычеркивать).
+    for (int i = 2; i * i <= n; i++) {
+        // Если число простое (не было вычеркнуто),
+        // то вычеркиваем все его кратные, начиная с i^2.
+        if (is_prime[i]) {
+            // Вычеркивание кратных числа i.
+            for (int j = i * i; j <= n; j += i) {
+                is_prime[j] = false; // Число не простое.
+            }
+        }
+    }
+
+    // Собираем все числа, которые остались простыми.
+    for (int i = 2; i <= n; i++) {
+        if (is_prime[i]) {
+            primes.push_back(i);
+        }
+    }
+    INSTRUMENT_COUNT("sieve.primes", primes.size());
+    return primes;
+}
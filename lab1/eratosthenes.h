@@ -0,0 +1,14 @@
+#ifndef LAB1_ERATOSTHENES_H
+#define LAB1_ERATOSTHENES_H
+
+#include <vector>
+
+/**
+ * @brief Поиск всех простых чисел до n включительно (решето Эратосфена), без ввода-вывода.
+ *
+ * @param n Верхний предел, до которого нужно найти простые числа.
+ * @return Простые числа в порядке возрастания.
+ */
+std::vector<int> sieve_of_eratosthenes(int n);
+
+#endif // LAB1_ERATOSTHENES_H
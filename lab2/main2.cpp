@@ -1,69 +1,14 @@
+// Сборка (из корня репозитория): g++ -std=c++17 -O2 lab2/main2.cpp lab2/matrix.cpp -o lab2_matrix
 #include <iostream>  // Для ввода и вывода данных
-#include <cctype>  // Для работы с символами (функция проверки символов - isdigit())
 #include <string>  // Для работы со строками, содержит класс std::string для хранения и обработки строк текста
 #include <limits>  // Для работы с предельными значениями типов данных (numeric_limits<streamsize>::max())
 #include <random>  // Для генерации случайных чисел (random_device, mt19937)
-#include <algorithm>  // Для работы с контейнерами: сортировка, поиск, перестановка и другие (shuffle())
-#include <vector>  // Предоставляет контейнер std::vector (vector<pair<int, int>>)
+#include <vector>  // Предоставляет контейнер std::vector (значения для заполнения массива)
 
-
-using namespace std;
-/**
- * @brief Функция проверки, является ли строка целым числом
- *
- * @param str Строка, которую нужно проверить
- * @param mode Режим проверки ("positive_int" для положительных чисел, "int" для любых целых чисел)
- * @return true Если строка является целым числом в заданном режиме
- * @return false Если строка не является целым числом
- */
-bool isValidInteger (const string& str, const string& mode) {
-    if (str.empty()) {
-        return false;  // Пустая строка не является допустимым числом
-    }
-
-    // Проверка на положительное целое число
-    if (mode == "positive_int") {
-        // Проверка, что все символы строки являются цифрами
-        for (char c : str) {  // Перебор каждого символа в строке
-            if (!isdigit(c)) {  // Если хотя бы один символ не является цифрой
-                return false;
-            }
-        }
-
-        /* Конструкция try-catch используется для безопасного преобразования строки в целое
-         * число с помощью функции stoi, которая может выбросить исключение,
-         * если преобразование не удаётся.
-         */
-        try {
-            int number = stoi(str);  // Преобразование строки в целое число
-            return number > 0;  // Возвращает true, если число положительное
-        } catch (const out_of_range&) {  // Если строка не может быть преобразована в int (например, слишком длинная),
-            return false;               // возвращает false
-        }
-    }
-
-    if (mode == "int") {  // Проверка на любое целое число
-        int i = 0;
-        if (str[0] == '-') {  // Если первый символ '-' (минус), пропускаем его для проверки цифр
-            i = 1;
-        }
-        // Проверка, что все символы после возможного минуса являются цифрами
-        for (; i < str.size(); i++) {
-            if (!isdigit(str[i])) {
-                return false;  // Если найден нецифровой символ, строка не является числом
-            }
-        }
-        try {
-            stoi(str);  // Попытка преобразования строки в целое число
-            return true;
-        } catch (const out_of_range&) {
-            return false;  // Если строка слишком длинная для типа int, возвращает false
-        }
-    }
-    return false;  // Если mode не соответствует ни одному из поддерживаемых значений, возвращает false
-}
+#include "matrix.h"  // Заполнение массивов без ввода-вывода
 
 
+using namespace std;
 /**
  * @brief Функция для получения размера массива от пользователя
  *
@@ -88,65 +33,38 @@ int arrSizeInput () {
 
 
 /**
- * @brief Функция для создания и инициализации нулями двумерного массива размером size x size
- *
- * @param size Размер массива (количество строк и столбцов)
- * @return Указатель на созданный и инициализированный двумерный массив
- */
-int** createAndInitializeArr(int size) {
-    /* Функция создает двумерный массив динамически и заполняет его нулями.
-     * Используются указатели, т.к. нужно динамически выделять память для массива,
-     * размер которого неизвестен во время компиляции. Указатели
-     * позволяют работать с динамически выделенной памятью, что дает гибкость
-     * в управлении массивами, особенно при работе с большими объемами данных.
-     */
-
-    int** arr = new int*[size];  // Выделение памяти для массива указателей на строки
-
-    for (int i = 0; i < size; i++) {
-        arr[i] = new int[size];  // Выделение памяти для каждой строки массива под столбцы
-        for (int j = 0; j < size; j++) {  // Инициализация всех элементов строки нулями
-            arr[i][j] = 0;
-        }
-    }
-    cout << "OK! An array with dimension [" << size << "x" << size << "] is created!" << endl;
-    cout << "Array was successfully initialized!\n" << endl;
-    return arr;  // Возврат указателя на созданный массив
-}
-
-
-/**
- * @brief Вывод двумерного массива в виде таблицы.
+ * @brief Функция для ввода значения одного элемента массива
  *
- * @param arr Указатель на двумерный массив
- * @param size Размер массива (N x N)
+ * Запрос повторяется, пока пользователь не введет корректное целое число.
+ * @param i Номер строки элемента
+ * @param j Номер столбца элемента
+ * @return Введенное значение
  */
-void printArr(int** arr, int size) {
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            // Вывод текущего элемента массива, добавление табуляции для удобства
-            cout << arr[i][j] << "\t";
+int inputElement(int i, int j) {
+    string input;
+    // Цикл для ввода корректного значения для элемента
+    while (true) {
+        cout << "Value for element [" << i << "][" << j << "]:\n";
+        cin >> input;
+        if (isValidInteger(input, "int")) {
+            return stoi(input);
         }
-        // После вывода одной строки переход на следующую строку
-        cout << endl;
+        cout << "~{ ERROR! Enter a valid integer! }~\n" << endl;
     }
 }
 
 
 /**
- * @brief Освобождение памяти, выделенной под двумерный массив
+ * @brief Функция для создания и инициализации нулями двумерного массива размером size x size
  *
- * Функция проходит по каждой строке массива, освобождая выделенную память для каждой строки,
- * а затем освобождает память, выделенную под указатели на строки.
- * Это предотвращает утечки памяти.
- * @param arr Указатель на двумерный массив
- * @param size Размер массива (N x N)
+ * @param size Размер массива (количество строк и столбцов)
+ * @return Указатель на созданный и инициализированный двумерный массив
  */
-void freeArr(int** arr, int size) {
-    for (int i = 0; i < size; i++) {
-        delete[] arr[i];
-    }
-    delete[] arr;
+int** createAndInitializeArr(int size) {
+    int** arr = createArr(size);  // Выделение памяти и инициализация нулями
+    cout << "OK! An array with dimension [" << size << "x" << size << "] is created!" << endl;
+    cout << "Array was successfully initialized!\n" << endl;
+    return arr;  // Возврат указателя на созданный массив
 }
 
 
@@ -159,11 +77,7 @@ void freeArr(int** arr, int size) {
 void clearAndFillWithZeros(int** arr, int size) {
     cout << "\n{ You chose the 1st action! }" << endl;
 
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            arr[i][j] = 0;
-        }
-    }
+    fillWithZeros(arr, size);
     // Вывод результатов очищения массива
     cout << "{ DONE! The array was filled with zeros: }" << endl;
     printArr(arr, size);
@@ -179,27 +93,18 @@ void clearAndFillWithZeros(int** arr, int size) {
  * @param size Размер массива (N x N)
  */
 void fillArrMainDiagonal(int** arr, int size) {
-    string input;
     cout << "\n{ You chose the 2nd action! }" << endl;
     cout << "Enter the values for the upper triangle of the matrix (including the diagonal):" << endl;
 
-    // Прохождение по верхнему треугольнику, включая главную диагональ
+    // Ввод значений верхнего треугольника, включая главную диагональ
+    vector<int> values;
     for (int i = 0; i < size; i++) {
         for (int j = i; j < size; j++) {
-            // Цикл для ввода корректного значения для каждого элемента
-            while (true) {
-                cout << "Value for element [" << i << "][" << j << "]:\n";
-                cin >> input;
-                if (isValidInteger(input, "int")) {
-                    arr[i][j] = stoi(input);  // Заполнение верхнего треугольника
-                    arr[j][i] = arr[i][j];  // Симметричное заполнение нижнего треугольника
-                    break;
-                } else {
-                    cout << "~{ ERROR! Enter a valid integer! }~\n" << endl;
-                }
-            }
+            values.push_back(inputElement(i, j));
         }
     }
+    fillMainDiagonalSymmetric(arr, size, values);
+
     // Вывод результатов заполнения массива
     cout << "{ DONE! The array now looks like this: }" << endl;
     printArr(arr, size);
@@ -215,27 +120,18 @@ void fillArrMainDiagonal(int** arr, int size) {
  * @param size Размер массива (N x N)
  */
 void fillArrSecDiagonal(int** arr, int size) {
-    string input;
     cout << "\n{ You chose the 3rd action! }" << endl;
     cout << "Enter the values for the upper triangle of the matrix (including the diagonal):" << endl;
 
-    // Прохождение по верхнему треугольнику, включая побочную диагональ
+    // Ввод значений верхнего треугольника, включая побочную диагональ
+    vector<int> values;
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size - i; j++) {
-            while (true) {
-                cout << "Value for element [" << i << "][" << j << "]:\n";
-                cin >> input;
-                // Цикл для ввода корректного значения для каждого элемента
-                if (isValidInteger(input, "int")) {
-                    arr[i][j] = stoi(input);  // Заполнение верхнего треугольника
-                    arr[size - 1 - j][size - 1 - i] = arr[i][j];  // Симметричное заполнение нижнего треугольника
-                    break;
-                } else {
-                    cout << "~{ ERROR! Enter a valid integer! }~\n" << endl;
-                }
-            }
+            values.push_back(inputElement(i, j));
         }
     }
+    fillSecDiagonalSymmetric(arr, size, values);
+
     // Вывод результатов заполнения массива
     cout << "{ DONE! The array now looks like this: }" << endl;
     printArr(arr, size);
@@ -260,18 +156,7 @@ void fillArrSecDiagonal(int** arr, int size) {
  */
 void fillArrPascalsTriangle(int** arr, int size) {
     // Проверка, что массив очищен (все элементы равны 0)
-    bool is_cleared = true;
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            if (arr[i][j] != 0) {
-                is_cleared = false;
-                break;
-            }
-        }
-        if (!is_cleared) {
-            break;
-        }
-    }
+    bool is_cleared = isArrCleared(arr, size);
     // Если массив не очищен, вывод предупреждения и выход из функции
     if (!is_cleared) {
         cout << "\n{ ERROR! The array is not cleared. "
@@ -280,17 +165,10 @@ void fillArrPascalsTriangle(int** arr, int size) {
     }
 
     // Ограничение выполнения функции для размеров < 35, чтобы вывод не перегружался
-    if (size < 35) {
+    if (size < PASCAL_MAX_SIZE) {
         cout << "\n{ You chose the 4th action! }" << endl;
 
-        for (int i = 0; i < size; i++) {  // Заполнение массива значениями треугольника Паскаля
-            arr[i][0] = 1;  // Первый элемент каждой строки равен 1
-            arr[i][i] = 1;  // Последний элемент строки всегда равен 1
-            for (int j = 1; j <= i; j++) {
-                // Каждый элемент равен сумме двух элементов над ним
-                arr[i][j] = arr[i - 1][j - 1] + arr[i - 1][j];
-            }
-        }
+        fillPascalsTriangle(arr, size);
         // Вывод результатов заполнения массива
         cout << "{ DONE! The array was filled as Pascal's triangle: }" << endl;
         printArr(arr, size);
@@ -337,52 +215,7 @@ void fillArrMines (int** arr, int size) {
     random_device rd;
     mt19937 generator(rd());  // Инициализация генератора случайных чисел
 
-    /*
-     * Вектор `cells` используется для хранения всех возможных координат поля,
-     * т.к. это позволяет легко перемешать их и затем выбирать случайные координаты для размещения мин.
-     * Вектору не надо задавать размер, так как он сам управляет им; позволяет использовать
-     * метод 'shuffle'; упрощает доступ к парам координат, которые обрабатываются с помощью метода
-     * `emplace_back`, сохраняя пары (i, j) для всех клеток поля.
-     */
-    vector<pair<int, int>> cells;
-    // Заполнение вектора всеми возможными координатами поля
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            cells.emplace_back(i, j);  // Добавление каждой координаты (i, j)
-        }
-    }
-    // Перемешивание координат для случайного распределения мин
-    shuffle(cells.begin(), cells.end(), generator);
-
-    // Размещение мины на случайных координатах
-    for (int i = 0; i < num_mines; i++) {
-        arr[cells[i].first][cells[i].second] = -1; // Обозначение мины '-1'
-    }
-
-    // Заполнение остальных клеток числами, обозначающими количество соседних мин
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            if (arr[i][j] == -1) {
-                continue;  // Пропуск клеток с минами
-            }
-            int count = 0;  // Счетчик мин вокруг текущей клетки
-
-            // Прохождение по соседним клеткам
-            for (int di = -1; di <= 1; di++) {  // Прохождение по всем возможным смещениям по строкам
-                for (int dj = -1; dj <= 1; dj++) {  // Прохождение по всем возможным смещениям по столбцам
-                    int ni = i + di;  // Вычисление индекса строки соседней ячейки
-                    int nj = j + dj;  // Вычисление индекса столбца соседней ячейки
-
-                    // Проверка нахождения соседней клетки в пределах массива и содержания мины
-                    if (ni >= 0 && ni < size && nj >= 0 && nj < size && arr[ni][nj] == -1) {
-                        count++; // Увеличение счетчика мин, если в соседней ячейке находится мина
-                    }
-                }
-            }
-            // Установка количества мин вокруг текущей ячейки
-            arr[i][j] = count;  // Присваивание ячейке (i, j) количества мин вокруг
-        }
-    }
+    fillMines(arr, size, num_mines, generator);
 
     cout << "{ DONE! The array was filled for MineSweeper: }" << endl;
     printArr(arr, size);
@@ -0,0 +1,289 @@
+#include "matrix.h"
+
+#include <iostream>  // Для вывода массива (printArr)
+#include <cctype>  // Для работы с символами (функция проверки символов - isdigit())
+#include <algorithm>  // Для работы с контейнерами: перестановка (shuffle())
+
+#include "../common/instrumentation.h"
+
+
+using namespace std;
+/**
+ * @brief Функция проверки, является ли строка целым числом
+ *
+ * @param str Строка, которую нужно проверить
+ * @param mode Режим проверки ("positive_int" для положительных чисел, "int" для любых целых чисел)
+ * @return true Если строка является целым числом в заданном режиме
+ * @return false Если строка не является целым числом
+ */
+bool isValidInteger (const string& str, const string& mode) {
+    if (str.empty()) {
+        return false;  // Пустая строка не является допустимым числом
+    }
+
+    // Проверка на положительное целое число
+    if (mode == "positive_int") {
+        // Проверка, что все символы строки являются цифрами
+        for (char c : str) {  // Перебор каждого символа в строке
+            if (!isdigit(c)) {  // Если хотя бы один символ не является цифрой
+                return false;
+            }
+        }
+
+        /* Конструкция try-catch используется для безопасного преобразования строки в целое
+         * число с помощью функции stoi, которая может выбросить исключение,
+         * если преобразование не удаётся.
+         */
+        try {
+            int number = stoi(str);  // Преобразование строки в целое число
+            return number > 0;  // Возвращает true, если число положительное
+        } catch (const out_of_range&) {  // Если строка не может быть преобразована в int (например, слишком длинная),
+            return false;               // возвращает false
+        }
+    }
+
+    if (mode == "int") {  // Проверка на любое целое число
+        int i = 0;
+        if (str[0] == '-') {  // Если первый символ '-' (минус), пропускаем его для проверки цифр
+            i = 1;
+        }
+        // Проверка, что все символы после возможного минуса являются цифрами
+        for (; i < str.size(); i++) {
+            if (!isdigit(str[i])) {
+                return false;  // Если найден нецифровой символ, строка не является числом
+            }
+        }
+        try {
+            stoi(str);  // Попытка преобразования строки в целое число
+            return true;
+        } catch (const out_of_range&) {
+            return false;  // Если строка слишком длинная для типа int, возвращает false
+        }
+    }
+    return false;  // Если mode не соответствует ни одному из поддерживаемых значений, возвращает false
+}
+
+
+
+/**
+ * @brief Выделение памяти под двумерный массив размером size x size и заполнение его нулями
+ *
+ * Используются указатели, т.к. нужно динамически выделять память для массива,
+ * размер которого неизвестен во время компиляции.
+ * @param size Размер массива (количество строк и столбцов)
+ * @return Указатель на созданный и инициализированный двумерный массив
+ */
+int** createArr(int size) {
+    int** arr = new int*[size];  // Выделение памяти для массива указателей на строки
+
+    for (int i = 0; i < size; i++) {
+        arr[i] = new int[size];  // Выделение памяти для каждой строки массива под столбцы
+        for (int j = 0; j < size; j++) {  // Инициализация всех элементов строки нулями
+            arr[i][j] = 0;
+        }
+    }
+    return arr;  // Возврат указателя на созданный массив
+}
+
+
+/**
+ * @brief Вывод двумерного массива в виде таблицы.
+ *
+ * @param arr Указатель на двумерный массив
+ * @param size Размер массива (N x N)
+ */
+void printArr(int** arr, int size) {
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            // Вывод текущего элемента массива, добавление табуляции для удобства
+            cout << arr[i][j] << "\t";
+        }
+        // После вывода одной строки переход на следующую строку
+        cout << endl;
+    }
+}
+
+
+
+/**
+ * @brief Освобождение памяти, выделенной под двумерный массив
+ *
+ * Функция проходит по каждой строке массива, освобождая выделенную память для каждой строки,
+ * а затем освобождает память, выделенную под указатели на строки.
+ * Это предотвращает утечки памяти.
+ * @param arr Указатель на двумерный массив
+ * @param size Размер массива (N x N)
+ */
+void freeArr(int** arr, int size) {
+    for (int i = 0; i < size; i++) {
+        delete[] arr[i];
+    }
+    delete[] arr;
+}
+
+
+
+/**
+ * @brief Заполнение массива нулями
+ *
+ * @param arr Указатель на двумерный массив
+ * @param size Размер массива (N x N)
+ */
+void fillWithZeros(int** arr, int size) {
+    INSTRUMENT_SCOPE("matrix.zeros");
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            arr[i][j] = 0;
+        }
+    }
+}
+
+
+/**
+ * @brief Проверка, что массив очищен (все элементы равны 0)
+ *
+ * @param arr Указатель на двумерный массив
+ * @param size Размер массива (N x N)
+ * @return true Если все элементы массива равны 0
+ */
+bool isArrCleared(int** arr, int size) {
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            if (arr[i][j] != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief Заполнение массива симметрично относительно главной диагонали
+ *
+ * @param arr Указатель на двумерный массив
+ * @param size Размер массива (N x N)
+ * @param values Значения верхней треугольной матрицы (включая главную диагональ)
+ * построчно, size * (size + 1) / 2 элементов
+ */
+void fillMainDiagonalSymmetric(int** arr, int size, const vector<int>& values) {
+    INSTRUMENT_SCOPE("matrix.main_diagonal");
+    size_t k = 0;
+    // Прохождение по верхнему треугольнику, включая главную диагональ
+    for (int i = 0; i < size; i++) {
+        for (int j = i; j < size; j++) {
+            arr[i][j] = values[k++];  // Заполнение верхнего треугольника
+            arr[j][i] = arr[i][j];  // Симметричное заполнение нижнего треугольника
+        }
+    }
+}
+
+
+/**
+ * @brief Заполнение массива симметрично относительно побочной диагонали
+ *
+ * @param arr Указатель на двумерный массив
+ * @param size Размер массива (N x N)
+ * @param values Значения верхней треугольной матрицы (включая побочную диагональ)
+ * построчно, size * (size + 1) / 2 элементов
+ */
+void fillSecDiagonalSymmetric(int** arr, int size, const vector<int>& values) {
+    INSTRUMENT_SCOPE("matrix.sec_diagonal");
+    size_t k = 0;
+    // Прохождение по верхнему треугольнику, включая побочную диагональ
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size - i; j++) {
+            arr[i][j] = values[k++];  // Заполнение верхнего треугольника
+            arr[size - 1 - j][size - 1 - i] = arr[i][j];  // Симметричное заполнение нижнего треугольника
+        }
+    }
+}
+
+
+/**
+ * @brief Заполнение очищенного массива значениями треугольника Паскаля
+ *
+ * - Каждый элемент является суммой двух элементов, находящихся над ним.
+ * - Первые и последние элементы каждой строки равны 1.
+ * @param arr Указатель на двумерный массив (должен быть заполнен нулями)
+ * @param size Размер массива (N x N)
+ * @return false Если size >= PASCAL_MAX_SIZE (значения не помещаются в int), массив не изменяется
+ */
+bool fillPascalsTriangle(int** arr, int size) {
+    if (size >= PASCAL_MAX_SIZE) {
+        return false;
+    }
+    INSTRUMENT_SCOPE("matrix.pascal");
+    for (int i = 0; i < size; i++) {  // Заполнение массива значениями треугольника Паскаля
+        arr[i][0] = 1;  // Первый элемент каждой строки равен 1
+        arr[i][i] = 1;  // Последний элемент строки всегда равен 1
+        for (int j = 1; j <= i; j++) {
+            // Каждый элемент равен сумме двух элементов над ним
+            arr[i][j] = arr[i - 1][j - 1] + arr[i - 1][j];
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief Заполнение массива для игры "Сапёр"
+ *
+ * Мины расставляются в случайных клетках, остальные клетки заполняются числами,
+ * показывающими количество мин в соседних клетках.
+ * @param arr Указатель на двумерный массив
+ * @param size Размер массива (N x N)
+ * @param numMines Количество мин (ограничивается количеством клеток)
+ * @param generator Генератор случайных чисел
+ */
+void fillMines(int** arr, int size, int numMines, mt19937& generator) {
+    INSTRUMENT_SCOPE("matrix.mines");
+    /*
+     * Вектор `cells` используется для хранения всех возможных координат поля,
+     * т.к. это позволяет легко перемешать их и затем выбирать случайные координаты для размещения мин.
+     * Вектору не надо задавать размер, так как он сам управляет им; позволяет использовать
+     * метод 'shuffle'; упрощает доступ к парам координат, которые обрабатываются с помощью метода
+     * `emplace_back`, сохраняя пары (i, j) для всех клеток поля.
+     */
+    vector<pair<int, int>> cells;
+    // Заполнение вектора всеми возможными координатами поля
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            cells.emplace_back(i, j);  // Добавление каждой координаты (i, j)
+        }
+    }
+    // Перемешивание координат для случайного распределения мин
+    shuffle(cells.begin(), cells.end(), generator);
+
+    // Размещение мины на случайных координатах
+    numMines = min(numMines, static_cast<int>(cells.size()));
+    for (int i = 0; i < numMines; i++) {
+        arr[cells[i].first][cells[i].second] = -1; // Обозначение мины '-1'
+    }
+
+    // Заполнение остальных клеток числами, обозначающими количество соседних мин
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            if (arr[i][j] == -1) {
+                continue;  // Пропуск клеток с минами
+            }
+            int count = 0;  // Счетчик мин вокруг текущей клетки
+
+            // Прохождение по соседним клеткам
+            for (int di = -1; di <= 1; di++) {  // Прохождение по всем возможным смещениям по строкам
+                for (int dj = -1; dj <= 1; dj++) {  // Прохождение по всем возможным смещениям по столбцам
+                    int ni = i + di;  // Вычисление индекса строки соседней ячейки
+                    int nj = j + dj;  // Вычисление индекса столбца соседней ячейки
+
+                    // Проверка нахождения соседней клетки в пределах массива и содержания мины
+                    if (ni >= 0 && ni < size && nj >= 0 && nj < size && arr[ni][nj] == -1) {
+                        count++; // Увеличение счетчика мин, если в соседней ячейке находится мина
+                    }
+                }
+            }
+            // Установка количества мин вокруг текущей ячейки
+            arr[i][j] = count;  // Присваивание ячейке (i, j) количества мин вокруг
+        }
+    }
+    INSTRUMENT_COUNT("matrix.mines.placed", numMines);
+}
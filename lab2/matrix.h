@@ -0,0 +1,27 @@
+#ifndef LAB2_MATRIX_H
+#define LAB2_MATRIX_H
+
+#include <random>
+#include <string>
+#include <vector>
+
+// Максимальный размер массива для треугольника Паскаля: при больших размерах значения переполняют int
+const int PASCAL_MAX_SIZE = 35;
+
+// Проверка ввода и вывод
+bool isValidInteger(const std::string& str, const std::string& mode);
+void printArr(int** arr, int size);
+
+// Выделение и освобождение памяти двумерного массива size x size
+int** createArr(int size);
+void freeArr(int** arr, int size);
+
+// Заполнение массива без ввода-вывода
+void fillWithZeros(int** arr, int size);
+bool isArrCleared(int** arr, int size);
+void fillMainDiagonalSymmetric(int** arr, int size, const std::vector<int>& values);
+void fillSecDiagonalSymmetric(int** arr, int size, const std::vector<int>& values);
+bool fillPascalsTriangle(int** arr, int size);
+void fillMines(int** arr, int size, int numMines, std::mt19937& generator);
+
+#endif // LAB2_MATRIX_H
@@ -1,143 +1,149 @@
+// Сборка (из корня репозитория): g++ -std=c++17 -O2 lab3/main.cpp lab3/string_queries.cpp -o lab3_strings
 #include <iostream>
 #include <string>
 #include <vector>
 #include <ctime>
 #include <cstdlib>
+#include <chrono>
 
-using namespace std;
+#include "string_queries.h"
 
-/*
- * Структура "String" для хранения строк с длиной и указателем на массив символов
- */
-struct String {
-    int length;           // Длина строки
-    char* data;           // Указатель на массив символов строки
-};
-
-/*
- * Генерация случайного символа из английского алфавита
- * return: случайный символ (a-z)
- */
-char generateRandomChar() {
-    return 'a' + rand() % 26;
-}
+using namespace std;
 
 /*
- * Генерация случайной строки заданной длины
+ * Выполнение всех запросов над внешним файлом вместо сгенерированных строк
  * Параметры:
- *   length: длина строки (по умолчанию 50)
- * return: строка, содержащая случайные символы
+ *   path: путь к текстовому файлу со строками, разделенными '\n'
+ * return: код завершения программы
  */
-string generateRandomString(int length = 50) {
-    string str(length, ' ');
-    for (int i = 0; i < length; ++i) {
-        str[i] = generateRandomChar();
+int runMappedCorpus(const string& path) {
+    MappedCorpus corpus;
+    auto openStart = chrono::steady_clock::now();
+    if (!openMappedCorpus(path, corpus)) {
+        cout << "~{ ERROR! Failed to map the input file '" << path << "'! }~" << endl;
+        return 1;
     }
-    return str;
-}
+    auto openTime = chrono::duration<double, milli>(chrono::steady_clock::now() - openStart).count();
+    cout << "Mapped " << corpus.size << " bytes, " << corpusLineCount(corpus)
+         << " lines indexed in " << openTime << " ms" << endl;
 
-/*
- * Инициализация массива структур типа "String" случайными строками
- * Параметры:
- *   arr: массив структур String
- *   n: количество строк в массиве
- */
-void initializeStringArray(String* arr, int n) {
-    for (int i = 0; i < n; ++i) {
-        arr[i].length = 50;  // Длина каждой строки фиксирована на 50 символов
-        arr[i].data = new char[50];
-        for (int j = 0; j < 50; ++j) {
-            arr[i].data[j] = generateRandomChar();
-        }
-    }
+    // Подсчет повторений символа
+    char symbol;
+    cout << "Enter a character to count its repetitions: ";
+    cin >> symbol;
+    cout << "The number of repetitions of the symbol '" << symbol << "' in the file: "
+         << countCharOccurrences(corpus, symbol) << endl;
+
+    // Поиск самой длинной повторяющейся последовательности
+    cout << "The longest sequence of repeated characters: " << findLongestRepetition(corpus) << endl;
+
+    // Складывание всех строк в одну итоговую строку (пишется прямо в вывод)
+    cout << "Concatenation of all strings: ";
+    concatenateStrings(corpus, cout);
+    cout << endl;
+
+    // Поиск вхождений подстроки
+    string substring;
+    cout << "Enter a substring to search for: ";
+    cin >> substring;
+    cout << "The number of occurrences of the substring '" << substring << "' in the file: "
+         << countSubstringOccurrences(corpus, substring) << endl;
+
+    closeMappedCorpus(corpus);
+    return 0;
 }
 
 /*
- * Подсчет количества вхождений символа в массиве строк std::string
+ * Поиск подстроки по ранее сохраненному индексу без генерации строк и построения индекса
  * Параметры:
- *   arr: массив строк std::string
- *   symbol: символ для поиска
- * return: количество вхождений символа
+ *   path: путь к файлу индекса (создается режимом --index)
+ * return: код завершения программы
  */
-int countCharOccurrences(const vector<string>& arr, char symbol) {
-    int count = 0;
-    for (const auto& str : arr) {
-        for (char c : str) {
-            if (c == symbol) {
-                ++count;
-            }
-        }
+int runLoadedIndex(const string& path) {
+    SuffixIndex index;
+    auto loadStart = chrono::steady_clock::now();
+    if (!loadSuffixIndex(path, index)) {
+        cout << "~{ ERROR! Failed to map the suffix index file '" << path << "'! }~" << endl;
+        return 1;
     }
-    return count;
+    auto loadTime = chrono::duration<double, milli>(chrono::steady_clock::now() - loadStart).count();
+    cout << "Suffix index mapped from '" << path << "' in " << loadTime << " ms, size: "
+         << suffixIndexMemory(index) << " bytes" << endl;
+
+    // Поиск вхождений подстроки
+    string substring;
+    cout << "Enter a substring to search for: ";
+    cin >> substring;
+    auto queryStart = chrono::steady_clock::now();
+    int indexedCount = countSubstringOccurrencesIndexed(index, substring);
+    auto queryTime = chrono::duration<double, micro>(chrono::steady_clock::now() - queryStart).count();
+    cout << "The number of occurrences of the substring '" << substring << "' by index: " << indexedCount << endl;
+    cout << "Indexed query latency: " << queryTime << " us" << endl;
+
+    freeSuffixIndex(index);
+    return 0;
 }
 
 /*
- * Поиск самой длинной последовательности повторяющихся символов в массиве строк
- * Параметры:
- *   arr: массив строк std::string
- * return: самая длинная последовательность символов в виде строки
+ * Основная функция программы
+ * Выполняет взаимодействие с пользователем и выводит результаты генерации данных
+ * Параметры командной строки:
+ *   --use-index: построить индекс подстрок и искать подстроку по нему вместо линейного просмотра
+ *   --index <path>: то же, но индекс сохраняется в файл и запрос выполняется по загруженному через mmap индексу
+ *   --load-index <path>: загрузить сохраненный ранее индекс через mmap и искать подстроку по нему
+ *                        (без генерации строк и построения индекса)
+ *   --input <path>: работать со строками из текстового файла (через mmap) вместо генерации;
+ *                   индекс подстрок строится только по сгенерированным строкам (32-битные позиции
+ *                   не покрывают большие файлы), поэтому вместе с флагами индекса не используется
  */
-string findLongestRepetition(const vector<string>& arr) {
-    string longestSequence;
-    for (const auto& str : arr) {
-        int currentLength = 1;
-        string currentSequence(1, str[0]);
-        for (int i = 1; i < str.length(); ++i) {
-            if (str[i] == str[i - 1]) {
-                currentSequence += str[i];
-                currentLength++;
-            } else {
-                currentLength = 1;
-                currentSequence = str[i];
-            }
+int main(int argc, char* argv[]) {
+    srand(static_cast<unsigned>(time(0)));  // Инициализация генератора случайных чисел
 
-            if (currentSequence.length() > longestSequence.length()) {
-                longestSequence = currentSequence;
-            }
+    bool useIndex = false;
+    string indexPath;
+    string loadIndexPath;
+    string inputPath;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--use-index") {
+            useIndex = true;
+            continue;
+        }
+        if (arg != "--index" && arg != "--load-index" && arg != "--input") {
+            cout << "~{ ERROR! Unknown option '" << arg << "'! }~" << endl;
+            return 1;
+        }
+        if (i + 1 >= argc) {
+            cout << "~{ ERROR! Option " << arg << " requires a path! }~" << endl;
+            return 1;
+        }
+        if (arg == "--index") {
+            useIndex = true;
+            indexPath = argv[++i];
+        } else if (arg == "--load-index") {
+            loadIndexPath = argv[++i];
+        } else {
+            inputPath = argv[++i];
         }
     }
-    return longestSequence;
-}
 
-/*
- * Конкатенация всех строк в массиве в одну итоговую строку
- * Параметры:
- *   arr: массив строк std::string
- * return: итоговая строка
- */
-string concatenateStrings(const vector<string>& arr) {
-    string result;
-    for (const auto& str : arr) {
-        result += str;
+    if (!inputPath.empty()) {
+        if (useIndex || !loadIndexPath.empty()) {
+            cout << "~{ ERROR! The suffix index is available only for generated strings, "
+                    "it can't be combined with --input! }~" << endl;
+            return 1;
+        }
+        return runMappedCorpus(inputPath);
     }
-    return result;
-}
 
-/*
- * Подсчет количества вхождений подстроки в массиве строк
- * Параметры:
- *   arr: массив строк std::string
- *   substring: подстрока для поиска
- * return: количество вхождений подстроки
- */
-int countSubstringOccurrences(const vector<string>& arr, const string& substring) {
-    int count = 0;
-    for (const auto& str : arr) {
-        size_t pos = str.find(substring);
-        while (pos != string::npos) {
-            ++count;
-            pos = str.find(substring, pos + 1);
+    if (!loadIndexPath.empty()) {
+        if (useIndex) {
+            cout << "~{ ERROR! --load-index uses an existing index, "
+                    "it can't be combined with --use-index or --index! }~" << endl;
+            return 1;
         }
+        return runLoadedIndex(loadIndexPath);
     }
-    return count;
-}
-
-/*
- * Основная функция программы
- * Выполняет взаимодействие с пользователем и выводит результаты генерации данных
- */
-int main() {
-    srand(static_cast<unsigned>(time(0)));  // Инициализация генератора случайных чисел
 
     // Получаем количество строк от пользователя
     int N;
@@ -173,9 +179,50 @@ int main() {
     string substring;
     cout << "Enter a substring to search for: ";
     cin >> substring;
-    int substringCount = countSubstringOccurrences(stdStringArray, substring);
-    cout << "The number of occurrences of the substring '" << substring << "' in the array: " << substringCount << endl;
 
+    // Построение индекса подстрок (только в режимах --use-index / --index)
+    SuffixIndex index;
+    bool indexReady = false;
+    if (useIndex) {
+        auto buildStart = chrono::steady_clock::now();
+        if (buildSuffixIndex(stdStringArray, index)) {
+            indexReady = true;
+            auto buildTime = chrono::duration<double, milli>(chrono::steady_clock::now() - buildStart).count();
+            cout << "Suffix index built in " << buildTime << " ms, memory: " << suffixIndexMemory(index) << " bytes" << endl;
+
+            // Сохранение индекса и повторная загрузка через mmap; при ошибке остается индекс в памяти
+            if (!indexPath.empty()) {
+                SuffixIndex mapped;
+                if (!saveSuffixIndex(index, indexPath)) {
+                    cout << "~{ ERROR! Failed to save the suffix index file, using the in-memory index! }~" << endl;
+                } else if (!loadSuffixIndex(indexPath, mapped)) {
+                    cout << "~{ ERROR! Failed to map the suffix index file, using the in-memory index! }~" << endl;
+                } else {
+                    swap(index, mapped);
+                    freeSuffixIndex(mapped);  // Освобождение индекса, построенного в памяти
+                    cout << "Suffix index saved and mapped from '" << indexPath << "'" << endl;
+                }
+            }
+        } else {
+            cout << "~{ ERROR! The array is too large for the suffix index, using the linear scan! }~" << endl;
+        }
+    }
+
+    if (indexReady) {
+        auto queryStart = chrono::steady_clock::now();
+        int indexedCount = countSubstringOccurrencesIndexed(index, substring);
+        auto queryTime = chrono::duration<double, micro>(chrono::steady_clock::now() - queryStart).count();
+        cout << "The number of occurrences of the substring '" << substring << "' by index: " << indexedCount << endl;
+        cout << "Indexed query latency: " << queryTime << " us" << endl;
+        freeSuffixIndex(index);
+    } else {
+        // Линейный просмотр всех строк (режим по умолчанию)
+        auto scanStart = chrono::steady_clock::now();
+        int substringCount = countSubstringOccurrences(stdStringArray, substring);
+        auto scanTime = chrono::duration<double, micro>(chrono::steady_clock::now() - scanStart).count();
+        cout << "The number of occurrences of the substring '" << substring << "' in the array: " << substringCount << endl;
+        cout << "Linear scan latency: " << scanTime << " us" << endl;
+    }
 
     // Освобождение памяти для массива структур String
     for (int i = 0; i < N; ++i) {
@@ -0,0 +1,714 @@
+#include "string_queries.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../common/instrumentation.h"
+
+using namespace std;
+
+/*
+ * Генерация случайного символа из английского алфавита
+ * return: случайный символ (a-z)
+ */
+char generateRandomChar() {
+    return 'a' + rand() % 26;
+}
+
+/*
+ * Генерация случайной строки заданной длины
+ * Параметры:
+ *   length: длина строки (по умолчанию 50)
+ * return: строка, содержащая случайные символы
+ */
+string generateRandomString(int length) {
+    string str(length, ' ');
+    for (int i = 0; i < length; ++i) {
+        str[i] = generateRandomChar();
+    }
+    return str;
+}
+
+/*
+ * Инициализация массива структур типа "String" случайными строками
+ * Параметры:
+ *   arr: массив структур String
+ *   n: количество строк в массиве
+ */
+void initializeStringArray(String* arr, int n) {
+    for (int i = 0; i < n; ++i) {
+        arr[i].length = 50;  // Длина каждой строки фиксирована на 50 символов
+        arr[i].data = new char[50];
+        for (int j = 0; j < 50; ++j) {
+            arr[i].data[j] = generateRandomChar();
+        }
+    }
+}
+
+/*
+ * Подсчет количества вхождений символа в одной строке
+ * Параметры:
+ *   str: строка (представление без копирования)
+ *   symbol: символ для поиска
+ * return: количество вхождений символа
+ */
+size_t countCharOccurrences(string_view str, char symbol) {
+    size_t count = 0;
+    for (char c : str) {
+        if (c == symbol) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/*
+ * Подсчет количества вхождений символа в массиве строк std::string
+ * Параметры:
+ *   arr: массив строк std::string
+ *   symbol: символ для поиска
+ * return: количество вхождений символа
+ */
+int countCharOccurrences(const vector<string>& arr, char symbol) {
+    INSTRUMENT_SCOPE("strings.count_char");
+    int count = 0;
+    for (const auto& str : arr) {
+        count += static_cast<int>(countCharOccurrences(string_view(str), symbol));
+    }
+    return count;
+}
+
+/*
+ * Обновление самой длинной последовательности повторяющихся символов по одной строке
+ * Последовательность запоминается только если она строго длиннее уже найденной,
+ * поэтому при равной длине сохраняется первая найденная.
+ * Параметры:
+ *   str: строка (представление без копирования)
+ *   longest: самая длинная последовательность, найденная ранее (представление внутри исходных данных)
+ */
+void updateLongestRepetition(string_view str, string_view& longest) {
+    size_t start = 0;
+    for (size_t i = 1; i <= str.length(); ++i) {
+        if (i == str.length() || str[i] != str[start]) {
+            if (i - start > longest.length()) {
+                longest = str.substr(start, i - start);
+            }
+            start = i;
+        }
+    }
+}
+
+/*
+ * Поиск самой длинной последовательности повторяющихся символов в массиве строк
+ * Параметры:
+ *   arr: массив строк std::string
+ * return: самая длинная последовательность символов в виде строки
+ */
+string findLongestRepetition(const vector<string>& arr) {
+    INSTRUMENT_SCOPE("strings.longest_repetition");
+    string_view longestSequence;
+    for (const auto& str : arr) {
+        updateLongestRepetition(str, longestSequence);
+    }
+    return string(longestSequence);
+}
+
+/*
+ * Конкатенация всех строк в массиве в одну итоговую строку
+ * Параметры:
+ *   arr: массив строк std::string
+ * return: итоговая строка
+ */
+string concatenateStrings(const vector<string>& arr) {
+    INSTRUMENT_SCOPE("strings.concatenate");
+    string result;
+    for (const auto& str : arr) {
+        result += str;
+    }
+    return result;
+}
+
+/*
+ * Подсчет количества вхождений подстроки в одной строке (вхождения могут перекрываться)
+ * Параметры:
+ *   str: строка (представление без копирования)
+ *   substring: подстрока для поиска
+ * return: количество вхождений подстроки
+ */
+size_t countSubstringOccurrences(string_view str, string_view substring) {
+    size_t count = 0;
+    size_t pos = str.find(substring);
+    while (pos != string_view::npos) {
+        ++count;
+        pos = str.find(substring, pos + 1);
+    }
+    return count;
+}
+
+/*
+ * Подсчет количества вхождений подстроки в массиве строк
+ * Параметры:
+ *   arr: массив строк std::string
+ *   substring: подстрока для поиска
+ * return: количество вхождений подстроки
+ */
+int countSubstringOccurrences(const vector<string>& arr, const string& substring) {
+    INSTRUMENT_SCOPE("strings.count_substring");
+    int count = 0;
+    for (const auto& str : arr) {
+        count += static_cast<int>(countSubstringOccurrences(string_view(str), string_view(substring)));
+    }
+    return count;
+}
+
+/*
+ * Оценка количества строк в файле по равномерно распределенным фрагментам
+ * Небольшие файлы просматриваются целиком, у больших читается около 1 МБ.
+ * Параметры:
+ *   data: начало отображенного файла
+ *   size: размер файла в байтах
+ * return: оценка количества символов '\n' с запасом 10%
+ */
+static size_t estimateLineCount(const char* data, size_t size) {
+    const size_t sampleCount = 16;           // Количество фрагментов
+    const size_t sampleBytes = 64 * 1024;    // Размер одного фрагмента
+    if (size <= sampleCount * sampleBytes) {
+        return static_cast<size_t>(count(data, data + size, '\n'));
+    }
+    size_t newlines = 0;
+    size_t step = (size - sampleBytes) / (sampleCount - 1);
+    for (size_t k = 0; k < sampleCount; ++k) {
+        const char* sample = data + k * step;
+        newlines += static_cast<size_t>(count(sample, sample + sampleBytes, '\n'));
+    }
+    double perByte = static_cast<double>(newlines) / static_cast<double>(sampleCount * sampleBytes);
+    return static_cast<size_t>(perByte * static_cast<double>(size) * 1.1);
+}
+
+/*
+ * Построение индекса начал строк (поиск '\n' по 16 байт за раз с помощью SSE2)
+ * Память под индекс резервируется заранее по оценке количества строк, чтобы при росте
+ * вектора не требовалось двойного объема памяти.
+ * Параметры:
+ *   corpus: корпус, для которого строится индекс
+ */
+static void buildLineIndex(MappedCorpus& corpus) {
+    INSTRUMENT_SCOPE("corpus.line_index");
+    corpus.lineStarts.clear();
+    if (corpus.size == 0) {
+        return;
+    }
+    const char* data = corpus.data;
+    size_t size = corpus.size;
+    corpus.lineStarts.reserve(estimateLineCount(data, size) + 2);  // + первая строка и фиктивное начало
+    corpus.lineStarts.push_back(0);
+
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; i + 16 <= size; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)));
+        while (mask != 0) {
+            corpus.lineStarts.push_back(i + __builtin_ctz(mask) + 1);
+            mask &= mask - 1;  // Сброс младшего найденного бита
+        }
+    }
+#endif
+    // Хвост файла (или весь файл без SSE2)
+    while (i < size) {
+        const void* found = memchr(data + i, '\n', size - i);
+        if (found == nullptr) {
+            break;
+        }
+        i = static_cast<size_t>(static_cast<const char*>(found) - data) + 1;
+        corpus.lineStarts.push_back(i);
+    }
+
+    // Последняя строка без завершающего '\n': фиктивное начало за концом файла
+    if (data[size - 1] != '\n') {
+        corpus.lineStarts.push_back(size + 1);
+    }
+    INSTRUMENT_COUNT("corpus.lines", corpus.lineStarts.size() - 1);
+}
+
+/*
+ * Открытие текстового файла и отображение его в память
+ * Ранее открытый в corpus файл освобождается.
+ * Параметры:
+ *   path: путь к файлу
+ *   corpus: корпус, который будет заполнен
+ * return: true, если файл успешно отображен и проиндексирован
+ */
+bool openMappedCorpus(const string& path, MappedCorpus& corpus) {
+    closeMappedCorpus(corpus);  // Освобождение ранее открытого файла, если он был
+
+    // O_NONBLOCK не влияет на обычные файлы, но не дает зависнуть на открытии FIFO
+    int fd = open(path.c_str(), O_RDONLY | O_NONBLOCK);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    // Отображать можно только обычный файл: у FIFO и устройств st_size == 0 не означает пустой корпус
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return false;
+    }
+    corpus.size = static_cast<size_t>(st.st_size);
+    if (corpus.size > 0) {
+        void* mapping = mmap(nullptr, corpus.size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        // Все запросы читают файл от начала к концу: агрессивное упреждающее чтение,
+        // прочитанные страницы можно вытеснять (файл может быть больше оперативной памяти)
+        madvise(mapping, corpus.size, MADV_SEQUENTIAL);
+        corpus.mapping = mapping;
+        corpus.mappingSize = corpus.size;
+        corpus.data = static_cast<const char*>(mapping);
+    }
+    close(fd);  // Отображение остается действительным после закрытия дескриптора
+    buildLineIndex(corpus);
+    return true;
+}
+
+/*
+ * Освобождение отображения файла
+ * Параметры:
+ *   corpus: корпус строк
+ */
+void closeMappedCorpus(MappedCorpus& corpus) {
+    if (corpus.mapping != nullptr) {
+        munmap(corpus.mapping, corpus.mappingSize);
+    }
+    corpus = MappedCorpus();
+}
+
+/*
+ * Количество строк в корпусе
+ * Параметры:
+ *   corpus: корпус строк
+ * return: количество строк
+ */
+size_t corpusLineCount(const MappedCorpus& corpus) {
+    return corpus.lineStarts.empty() ? 0 : corpus.lineStarts.size() - 1;
+}
+
+/*
+ * Строка корпуса без завершающего '\n'
+ * Параметры:
+ *   corpus: корпус строк
+ *   i: номер строки
+ * return: представление строки поверх отображенных страниц
+ */
+string_view corpusLine(const MappedCorpus& corpus, size_t i) {
+    uint64_t start = corpus.lineStarts[i];
+    return string_view(corpus.data + start, corpus.lineStarts[i + 1] - start - 1);
+}
+
+/*
+ * Подсчет количества вхождений символа в корпусе
+ * Параметры:
+ *   corpus: корпус строк
+ *   symbol: символ для поиска
+ * return: количество вхождений символа
+ */
+uint64_t countCharOccurrences(const MappedCorpus& corpus, char symbol) {
+    INSTRUMENT_SCOPE("corpus.count_char");
+    uint64_t count = 0;
+    for (size_t i = 0; i < corpusLineCount(corpus); ++i) {
+        count += countCharOccurrences(corpusLine(corpus, i), symbol);
+    }
+    return count;
+}
+
+/*
+ * Поиск самой длинной последовательности повторяющихся символов в корпусе
+ * Параметры:
+ *   corpus: корпус строк
+ * return: представление найденной последовательности внутри отображенного файла
+ */
+string_view findLongestRepetition(const MappedCorpus& corpus) {
+    INSTRUMENT_SCOPE("corpus.longest_repetition");
+    string_view longestSequence;
+    for (size_t i = 0; i < corpusLineCount(corpus); ++i) {
+        updateLongestRepetition(corpusLine(corpus, i), longestSequence);
+    }
+    return longestSequence;
+}
+
+/*
+ * Конкатенация всех строк корпуса с записью результата в поток
+ * Итоговая строка не собирается в памяти: строки пишутся в поток прямо из отображенных страниц.
+ * Параметры:
+ *   corpus: корпус строк
+ *   out: поток для записи результата
+ * return: длина итоговой строки
+ */
+uint64_t concatenateStrings(const MappedCorpus& corpus, ostream& out) {
+    INSTRUMENT_SCOPE("corpus.concatenate");
+    uint64_t length = 0;
+    for (size_t i = 0; i < corpusLineCount(corpus); ++i) {
+        string_view line = corpusLine(corpus, i);
+        out.write(line.data(), static_cast<streamsize>(line.length()));
+        length += line.length();
+    }
+    return length;
+}
+
+/*
+ * Подсчет количества вхождений подстроки в корпусе
+ * Параметры:
+ *   corpus: корпус строк
+ *   substring: подстрока для поиска
+ * return: количество вхождений подстроки
+ */
+uint64_t countSubstringOccurrences(const MappedCorpus& corpus, const string& substring) {
+    INSTRUMENT_SCOPE("corpus.count_substring");
+    uint64_t count = 0;
+    for (size_t i = 0; i < corpusLineCount(corpus); ++i) {
+        count += countSubstringOccurrences(corpusLine(corpus, i), string_view(substring));
+    }
+    return count;
+}
+
+const char SUFFIX_INDEX_MAGIC[8] = {'S', 'A', 'I', 'D', 'X', '0', '1', '\0'};  // Сигнатура файла индекса
+const size_t SUFFIX_INDEX_HEADER = 16;  // Сигнатура (8 байт) + длина текста (8 байт)
+
+/*
+ * Построение суффиксного массива алгоритмом SA-IS (индуцированная сортировка) за O(n)
+ * Параметры:
+ *   s: текст в виде массива кодов символов
+ *   upper: максимальный код символа в тексте
+ * return: суффиксный массив (позиции суффиксов в лексикографическом порядке)
+ */
+vector<int32_t> buildSuffixArraySAIS(const vector<int32_t>& s, int32_t upper) {
+    int32_t n = static_cast<int32_t>(s.size());
+    if (n == 0) {
+        return {};
+    }
+    if (n == 1) {
+        return {0};
+    }
+    if (n == 2) {
+        return s[0] < s[1] ? vector<int32_t>{0, 1} : vector<int32_t>{1, 0};
+    }
+
+    // Классификация суффиксов: S-тип (ls = true) или L-тип (ls = false)
+    vector<int32_t> sa(n);
+    vector<bool> ls(n, false);
+    for (int32_t i = n - 2; i >= 0; --i) {
+        ls[i] = (s[i] == s[i + 1]) ? ls[i + 1] : (s[i] < s[i + 1]);
+    }
+
+    // Границы корзин: sumL - начало L-части корзины, sumS - начало S-части
+    vector<int32_t> sumL(upper + 2, 0), sumS(upper + 2, 0);
+    for (int32_t i = 0; i < n; ++i) {
+        if (!ls[i]) {
+            sumS[s[i]]++;
+        } else {
+            sumL[s[i] + 1]++;
+        }
+    }
+    for (int32_t i = 0; i <= upper; ++i) {
+        sumS[i] += sumL[i];
+        sumL[i + 1] += sumS[i];
+    }
+
+    // Индуцированная сортировка L- и S-суффиксов по заданному порядку LMS-суффиксов
+    auto induce = [&](const vector<int32_t>& lms) {
+        fill(sa.begin(), sa.end(), -1);
+        vector<int32_t> buf(upper + 2);
+        copy(sumS.begin(), sumS.end(), buf.begin());
+        for (int32_t d : lms) {
+            if (d != n) {
+                sa[buf[s[d]]++] = d;
+            }
+        }
+        copy(sumL.begin(), sumL.end(), buf.begin());
+        sa[buf[s[n - 1]]++] = n - 1;
+        for (int32_t i = 0; i < n; ++i) {
+            int32_t v = sa[i];
+            if (v >= 1 && !ls[v - 1]) {
+                sa[buf[s[v - 1]]++] = v - 1;
+            }
+        }
+        copy(sumL.begin(), sumL.end(), buf.begin());
+        for (int32_t i = n - 1; i >= 0; --i) {
+            int32_t v = sa[i];
+            if (v >= 1 && ls[v - 1]) {
+                sa[--buf[s[v - 1] + 1]] = v - 1;
+            }
+        }
+    };
+
+    // Поиск LMS-позиций (S-суффикс, перед которым стоит L-суффикс)
+    vector<int32_t> lmsMap(n + 1, -1);
+    vector<int32_t> lms;
+    for (int32_t i = 1; i < n; ++i) {
+        if (!ls[i - 1] && ls[i]) {
+            lmsMap[i] = static_cast<int32_t>(lms.size());
+            lms.push_back(i);
+        }
+    }
+    int32_t m = static_cast<int32_t>(lms.size());
+
+    induce(lms);
+
+    if (m > 0) {
+        // Нумерация LMS-подстрок в отсортированном порядке
+        vector<int32_t> sortedLms;
+        sortedLms.reserve(m);
+        for (int32_t v : sa) {
+            if (lmsMap[v] != -1) {
+                sortedLms.push_back(v);
+            }
+        }
+        vector<int32_t> recS(m);
+        int32_t recUpper = 0;
+        recS[lmsMap[sortedLms[0]]] = 0;
+        for (int32_t i = 1; i < m; ++i) {
+            int32_t l = sortedLms[i - 1];
+            int32_t r = sortedLms[i];
+            int32_t endL = (lmsMap[l] + 1 < m) ? lms[lmsMap[l] + 1] : n;
+            int32_t endR = (lmsMap[r] + 1 < m) ? lms[lmsMap[r] + 1] : n;
+            bool same = true;
+            if (endL - l != endR - r) {
+                same = false;
+            } else {
+                while (l < endL && s[l] == s[r]) {
+                    ++l;
+                    ++r;
+                }
+                if (l == n || s[l] != s[r]) {
+                    same = false;
+                }
+            }
+            if (!same) {
+                ++recUpper;
+            }
+            recS[lmsMap[sortedLms[i]]] = recUpper;
+        }
+
+        // Рекурсивная сортировка сокращенной строки и финальная индукция
+        vector<int32_t> recSa = buildSuffixArraySAIS(recS, recUpper);
+        for (int32_t i = 0; i < m; ++i) {
+            sortedLms[i] = lms[recSa[i]];
+        }
+        induce(sortedLms);
+    }
+    return sa;
+}
+
+/*
+ * Построение индекса подстрок над массивом строк
+ * Параметры:
+ *   arr: массив строк std::string
+ *   index: индекс, который будет заполнен
+ * return: true, если индекс построен; false, если текст не помещается в 32-битный индекс
+ */
+bool buildSuffixIndex(const vector<string>& arr, SuffixIndex& index) {
+    INSTRUMENT_SCOPE("suffix_index.build");
+    size_t total = 0;
+    for (const auto& str : arr) {
+        total += str.length() + 1;  // Строка + разделитель
+    }
+    if (total > static_cast<size_t>(INT32_MAX)) {
+        return false;
+    }
+
+    index.ownedText.clear();
+    index.ownedText.reserve(total);
+    for (const auto& str : arr) {
+        index.ownedText.insert(index.ownedText.end(), str.begin(), str.end());
+        index.ownedText.push_back('\n');
+    }
+
+    vector<int32_t> codes(total);
+    for (size_t i = 0; i < total; ++i) {
+        codes[i] = static_cast<unsigned char>(index.ownedText[i]);
+    }
+    index.ownedSa = buildSuffixArraySAIS(codes, 255);
+
+    index.text = index.ownedText.data();
+    index.sa = index.ownedSa.data();
+    index.length = static_cast<int32_t>(total);
+    INSTRUMENT_COUNT("suffix_index.bytes", suffixIndexMemory(index));
+    return true;
+}
+
+/*
+ * Объем памяти, занимаемый индексом
+ * Параметры:
+ *   index: индекс подстрок
+ * return: размер текста и суффиксного массива в байтах
+ */
+size_t suffixIndexMemory(const SuffixIndex& index) {
+    if (index.mapping != nullptr) {
+        return index.mappingSize;
+    }
+    return index.ownedText.capacity() + index.ownedSa.capacity() * sizeof(int32_t);
+}
+
+/*
+ * Смещение суффиксного массива в файле индекса (выравнивание по 4 байтам)
+ * Параметры:
+ *   length: длина текста индекса
+ * return: смещение от начала файла в байтах
+ */
+static size_t suffixArrayOffset(size_t length) {
+    return SUFFIX_INDEX_HEADER + (length + 3) / 4 * 4;
+}
+
+/*
+ * Сохранение индекса на диск
+ * Формат: сигнатура, длина текста (uint64), текст, выравнивание, суффиксный массив (int32)
+ * Параметры:
+ *   index: индекс подстрок
+ *   path: путь к файлу
+ * return: true, если файл успешно записан
+ */
+bool saveSuffixIndex(const SuffixIndex& index, const string& path) {
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) {
+        return false;
+    }
+    uint64_t length = static_cast<uint64_t>(index.length);
+    out.write(SUFFIX_INDEX_MAGIC, sizeof(SUFFIX_INDEX_MAGIC));
+    out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    out.write(index.text, index.length);
+    const char padding[4] = {0, 0, 0, 0};
+    out.write(padding, suffixArrayOffset(length) - SUFFIX_INDEX_HEADER - length);
+    out.write(reinterpret_cast<const char*>(index.sa), static_cast<streamsize>(length * sizeof(int32_t)));
+    return static_cast<bool>(out);
+}
+
+/*
+ * Загрузка индекса с диска через mmap (без копирования в память процесса)
+ * Проверяются только сигнатура и размер файла: суффиксный массив не читается целиком при загрузке,
+ * а позиции из него проверяются при каждом сравнении (compareSuffix).
+ * Параметры:
+ *   path: путь к файлу индекса
+ *   index: индекс, который будет заполнен указателями на отображение
+ * return: true, если файл корректен и отображен
+ */
+bool loadSuffixIndex(const string& path, SuffixIndex& index) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < SUFFIX_INDEX_HEADER) {
+        close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // Отображение остается действительным после закрытия дескриптора
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    const char* bytes = static_cast<const char*>(mapping);
+    uint64_t length;
+    memcpy(&length, bytes + sizeof(SUFFIX_INDEX_MAGIC), sizeof(length));
+    if (memcmp(bytes, SUFFIX_INDEX_MAGIC, sizeof(SUFFIX_INDEX_MAGIC)) != 0
+        || length > static_cast<uint64_t>(INT32_MAX)
+        || size != suffixArrayOffset(length) + length * sizeof(int32_t)) {
+        munmap(mapping, size);
+        return false;
+    }
+
+    index.ownedText.clear();
+    index.ownedSa.clear();
+    index.mapping = mapping;
+    index.mappingSize = size;
+    index.text = bytes + SUFFIX_INDEX_HEADER;
+    index.sa = reinterpret_cast<const int32_t*>(bytes + suffixArrayOffset(length));
+    index.length = static_cast<int32_t>(length);
+    return true;
+}
+
+/*
+ * Освобождение ресурсов индекса (память или отображение файла)
+ * Параметры:
+ *   index: индекс подстрок
+ */
+void freeSuffixIndex(SuffixIndex& index) {
+    if (index.mapping != nullptr) {
+        munmap(index.mapping, index.mappingSize);
+    }
+    index = SuffixIndex();
+}
+
+/*
+ * Сравнение суффикса текста с подстрокой (только по первым substring.length() символам)
+ * Параметры:
+ *   index: индекс подстрок
+ *   pos: начало суффикса в тексте
+ *   substring: искомая подстрока
+ * return: <0, если суффикс меньше; 0, если подстрока является префиксом суффикса; >0, если больше
+ *         (позиция вне текста из поврежденного файла считается несовпадением)
+ */
+static int compareSuffix(const SuffixIndex& index, int32_t pos, const string& substring) {
+    if (pos < 0 || pos >= index.length) {
+        return 1;
+    }
+    size_t available = static_cast<size_t>(index.length - pos);
+    size_t n = min(available, substring.length());
+    int cmp = memcmp(index.text + pos, substring.data(), n);
+    if (cmp != 0) {
+        return cmp;
+    }
+    return n < substring.length() ? -1 : 0;  // Суффикс короче подстроки - он меньше
+}
+
+/*
+ * Подсчет количества вхождений подстроки с помощью индекса за O(m log n)
+ * Параметры:
+ *   index: индекс подстрок
+ *   substring: подстрока для поиска
+ * return: количество вхождений подстроки (совпадает с countSubstringOccurrences)
+ */
+int countSubstringOccurrencesIndexed(const SuffixIndex& index, const string& substring) {
+    if (substring.empty()) {
+        // Как и линейный поиск: пустая подстрока встречается length + 1 раз в каждой строке,
+        // что в сумме равно длине текста индекса (строки + разделители)
+        return index.length;
+    }
+    if (index.length == 0) {
+        return 0;
+    }
+    // Нижняя граница: первый суффикс, не меньший подстроки
+    int32_t lo = 0, hi = index.length;
+    while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        if (compareSuffix(index, index.sa[mid], substring) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    int32_t first = lo;
+    // Верхняя граница: первый суффикс, больший подстроки
+    hi = index.length;
+    while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        if (compareSuffix(index, index.sa[mid], substring) <= 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo - first;
+}
@@ -0,0 +1,83 @@
+#ifndef LAB3_STRING_QUERIES_H
+#define LAB3_STRING_QUERIES_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Структура "String" для хранения строк с длиной и указателем на массив символов
+ */
+struct String {
+    int length;           // Длина строки
+    char* data;           // Указатель на массив символов строки
+};
+
+/*
+ * Внешний корпус строк: текстовый файл, отображенный в память через mmap.
+ * Строки разделены символом '\n' и доступны как std::string_view поверх страниц файла,
+ * без копирования в std::string. Единственная копия в куче - индекс начал строк:
+ * 8 байт на строку (например, около 3 ГБ для 40 ГБ журнала со строками по 100 байт).
+ */
+struct MappedCorpus {
+    const char* data = nullptr;        // Начало отображенного файла
+    size_t size = 0;                   // Размер файла в байтах
+    std::vector<uint64_t> lineStarts;  // Смещения начал строк + фиктивное начало после последней строки
+    void* mapping = nullptr;           // Отображение файла (nullptr для пустого файла)
+    size_t mappingSize = 0;            // Размер отображения
+};
+
+/*
+ * Индекс подстрок: суффиксный массив над конкатенацией всех строк.
+ * Строки разделяются символом '\n', который не входит в алфавит a-z,
+ * поэтому найденные вхождения никогда не пересекают границы строк.
+ * Индекс либо строится в памяти, либо загружается из файла через mmap.
+ */
+struct SuffixIndex {
+    const char* text = nullptr;        // Текст индекса (строки через разделитель)
+    const int32_t* sa = nullptr;       // Суффиксный массив
+    int32_t length = 0;                // Длина текста и суффиксного массива
+    std::vector<char> ownedText;       // Хранилище текста при построении в памяти
+    std::vector<int32_t> ownedSa;      // Хранилище суффиксного массива при построении в памяти
+    void* mapping = nullptr;           // Отображение файла индекса (nullptr, если индекс в памяти)
+    size_t mappingSize = 0;            // Размер отображения в байтах
+};
+
+// Генерация строк
+char generateRandomChar();
+std::string generateRandomString(int length = 50);
+void initializeStringArray(String* arr, int n);
+
+// Запросы к одной строке (представление без копирования)
+size_t countCharOccurrences(std::string_view str, char symbol);
+void updateLongestRepetition(std::string_view str, std::string_view& longest);
+size_t countSubstringOccurrences(std::string_view str, std::string_view substring);
+
+// Запросы к массиву строк std::string
+int countCharOccurrences(const std::vector<std::string>& arr, char symbol);
+std::string findLongestRepetition(const std::vector<std::string>& arr);
+std::string concatenateStrings(const std::vector<std::string>& arr);
+int countSubstringOccurrences(const std::vector<std::string>& arr, const std::string& substring);
+
+// Внешний корпус, отображенный в память
+bool openMappedCorpus(const std::string& path, MappedCorpus& corpus);
+void closeMappedCorpus(MappedCorpus& corpus);
+size_t corpusLineCount(const MappedCorpus& corpus);
+std::string_view corpusLine(const MappedCorpus& corpus, size_t i);
+uint64_t countCharOccurrences(const MappedCorpus& corpus, char symbol);
+std::string_view findLongestRepetition(const MappedCorpus& corpus);
+uint64_t concatenateStrings(const MappedCorpus& corpus, std::ostream& out);
+uint64_t countSubstringOccurrences(const MappedCorpus& corpus, const std::string& substring);
+
+// Индекс подстрок
+std::vector<int32_t> buildSuffixArraySAIS(const std::vector<int32_t>& s, int32_t upper);
+bool buildSuffixIndex(const std::vector<std::string>& arr, SuffixIndex& index);
+size_t suffixIndexMemory(const SuffixIndex& index);
+bool saveSuffixIndex(const SuffixIndex& index, const std::string& path);
+bool loadSuffixIndex(const std::string& path, SuffixIndex& index);
+void freeSuffixIndex(SuffixIndex& index);
+int countSubstringOccurrencesIndexed(const SuffixIndex& index, const std::string& substring);
+
+#endif // LAB3_STRING_QUERIES_H